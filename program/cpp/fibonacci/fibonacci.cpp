@@ -8,12 +8,15 @@
  */
 
 #include "fibonacci.h"
+#include "fibonacci_batch.h"
 #include <iostream>
 #include <iomanip>
+#include <stdexcept>
+#include <string>
 
 using namespace Fibonacci;
 
-int main() {
+static int run_demo() {
     std::cout << "🔢 Constexpr Fibonacci Implementation\n";
     std::cout << "=====================================\n\n";
 
@@ -82,4 +85,26 @@ int main() {
     std::cout << "• Pre-computed arrays for common values\n";
 
     return 0;
-} 
\ No newline at end of file
+} 
+
+int main(int argc, char** argv) {
+    if (argc > 1 && std::string(argv[1]) == "--batch") {
+        try {
+            run_batch(parse_batch_options(argc - 2, argv + 2));
+        } catch (const std::invalid_argument& e) {
+            std::cerr << "fibonacci: " << e.what() << "\n\n" << batch_usage();
+            return 2;
+        } catch (const std::exception& e) {
+            std::cerr << "fibonacci: " << e.what() << "\n";
+            return 1;
+        }
+        return 0;
+    }
+
+    if (argc > 1) {
+        std::cerr << batch_usage();
+        return 2;
+    }
+
+    return run_demo();
+}
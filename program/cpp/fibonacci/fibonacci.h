@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <array>
 #include <vector>
@@ -86,6 +87,77 @@ namespace Fibonacci {
         return (b == num) ? position : -1;
     }
 
+    /**
+     * @brief Largest n for which F(n) fits in a uint64_t
+     */
+    constexpr uint32_t MAX_FIBONACCI_INDEX = 93;
+
+    /**
+     * @brief Builds the table of every Fibonacci number that fits in a uint64_t
+     * 
+     * Uses iteration rather than fibonacci() so the whole table stays cheap
+     * to evaluate at compile time.
+     * 
+     * @return Array containing F(0) to F(MAX_FIBONACCI_INDEX)
+     */
+    constexpr std::array<uint64_t, MAX_FIBONACCI_INDEX + 1> fibonacci_table() {
+        std::array<uint64_t, MAX_FIBONACCI_INDEX + 1> result{};
+        result[1] = 1;
+        for (size_t i = 2; i <= MAX_FIBONACCI_INDEX; ++i) {
+            result[i] = result[i - 1] + result[i - 2];
+        }
+        return result;
+    }
+
+    namespace detail {
+
+        /**
+         * @brief Fast doubling for F(n) mod m, using Wide for residue products
+         */
+        template<typename Wide>
+        constexpr uint64_t fibonacci_mod_doubling(uint64_t n, uint64_t m) {
+            int bit = 63;
+            while (bit >= 0 && ((n >> bit) & 1) == 0) {
+                --bit;
+            }
+
+            // a = F(k), b = F(k + 1), walking k up from 0 one bit of n at a time
+            Wide a = 0, b = 1 % m;
+            for (; bit >= 0; --bit) {
+                Wide c = a * ((2 * b + m - a) % m) % m;   // F(2k)
+                Wide d = (a * a % m + b * b % m) % m;     // F(2k + 1)
+                if ((n >> bit) & 1) {
+                    a = d;
+                    b = (c + d) % m;
+                } else {
+                    a = c;
+                    b = d;
+                }
+            }
+            return static_cast<uint64_t>(a);
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Calculates F(n) mod m using fast doubling
+     * 
+     * Works for any n, including positions whose Fibonacci number
+     * overflows uint64_t.
+     * 
+     * @param n The position in the Fibonacci sequence (0-based)
+     * @param m The modulus, must be non-zero
+     * @return F(n) mod m
+     */
+    constexpr uint64_t fibonacci_mod(uint64_t n, uint64_t m) {
+        // Products of two residues only need 128 bits once m exceeds 2^32
+        return m <= (uint64_t{1} << 32) ? detail::fibonacci_mod_doubling<uint64_t>(n, m)
+                                         : detail::fibonacci_mod_doubling<unsigned __int128>(n, m);
+    }
+
+    // Every Fibonacci number representable in a uint64_t, in ascending order
+    constexpr auto FIBONACCI_TABLE = fibonacci_table();
+
     // Pre-computed Fibonacci numbers for common use cases
     constexpr uint64_t FIBONACCI_20[] = {
         fibonacci(0), fibonacci(1), fibonacci(2), fibonacci(3), fibonacci(4),
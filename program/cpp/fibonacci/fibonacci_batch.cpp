@@ -0,0 +1,793 @@
+/**
+ * @file fibonacci_batch.cpp
+ * @author Ahmed Al-Mansouri (ahmed@bridgesforpeace.org)
+ * @brief Streaming batch mode for the fibonacci program
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Bridges for Peace (c) 2025
+ */
+
+#include "fibonacci_batch.h"
+#include "fibonacci.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Fibonacci {
+
+    namespace {
+
+        // Input is handed to the workers in blocks of this size
+        constexpr size_t BLOCK_SIZE = 16 * 1024 * 1024;
+
+        // Blocks smaller than this are not worth splitting across threads
+        constexpr size_t MIN_RANGE_SIZE = 256 * 1024;
+
+        // Longest line a single result can produce: 20 digits plus newline
+        constexpr size_t MAX_RESULT_LENGTH = 21;
+
+        // Upper bound for --threads
+        constexpr unsigned MAX_THREADS = 1024;
+
+        constexpr const char* OUT_OF_RANGE_MESSAGE = "input value does not fit in 64 bits";
+
+        constexpr uint64_t ONES = 0x0101010101010101ULL;
+
+        // ========================================================================
+        // Integer parsing
+        // ========================================================================
+
+        /**
+         * Converts eight digit values (0-9, one per byte, most significant digit
+         * in the lowest byte) into an integer with three multiplications.
+         */
+        constexpr uint64_t parse_eight_digits(uint64_t digits) {
+            digits = (digits * 10) + (digits >> 8);
+            digits = (((digits & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+                      (((digits >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+            return digits;
+        }
+
+        /**
+         * Returns a word with a non-zero byte wherever the matching input byte,
+         * already XOR-ed with '0', is not a digit.
+         */
+        constexpr uint64_t non_digit_mask(uint64_t values) {
+            return (values & (0xF0 * ONES)) | (((values & (0x0F * ONES)) + 0x06 * ONES) & (0x10 * ONES));
+        }
+
+        /**
+         * Packs the digit values of text, first digit in the lowest byte, the
+         * way parse_number loads them from memory.
+         */
+        constexpr uint64_t digit_word(const char* text, unsigned length) {
+            uint64_t word = 0;
+            for (unsigned i = 0; i < length; ++i) {
+                word |= static_cast<uint64_t>(text[i] - '0') << (8 * i);
+            }
+            return word;
+        }
+
+        static_assert(parse_eight_digits(digit_word("00000000", 8)) == 0, "all zeros");
+        static_assert(parse_eight_digits(digit_word("00000001", 8)) == 1, "last digit only");
+        static_assert(parse_eight_digits(digit_word("10000000", 8)) == 10000000, "first digit only");
+        static_assert(parse_eight_digits(digit_word("12345678", 8)) == 12345678, "digit order");
+        static_assert(parse_eight_digits(digit_word("99999999", 8)) == 99999999, "largest run");
+        static_assert(parse_eight_digits(digit_word("123", 3) << 40) == 123, "short run shifted into place");
+        static_assert(non_digit_mask(digit_word("12345678", 8)) == 0, "all digits");
+        static_assert(non_digit_mask(digit_word("1234567", 7) | (uint64_t{' ' ^ '0'} << 56)) == uint64_t{0x10} << 56,
+                      "separator after seven digits");
+
+        constexpr bool is_digit(char c) {
+            return static_cast<unsigned char>(c - '0') < 10;
+        }
+
+        // Values in text input are separated by whitespace, commas or semicolons
+        constexpr bool is_separator(char c) {
+            return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f' ||
+                   c == ',' || c == ';';
+        }
+
+        [[noreturn]] void throw_unexpected_character(char c) {
+            if (c == '-') {
+                throw std::runtime_error("negative input values are not supported");
+            }
+            char shown[8];
+            if (std::isprint(static_cast<unsigned char>(c))) {
+                std::snprintf(shown, sizeof(shown), "'%c'", c);
+            } else {
+                std::snprintf(shown, sizeof(shown), "0x%02X", static_cast<unsigned char>(c));
+            }
+            throw std::runtime_error(std::string("unexpected character ") + shown + " in input");
+        }
+
+        /**
+         * Whether the digit run [begin, end), without leading zeros, fits in
+         * uint64_t. UINT64_MAX has 20 digits, so only 20-digit runs need a
+         * closer look.
+         */
+        inline bool fits_in_uint64(const char* begin, const char* end) {
+            size_t length = static_cast<size_t>(end - begin);
+            return length < 20 || (length == 20 && std::memcmp(begin, "18446744073709551615", 20) <= 0);
+        }
+
+        constexpr uint64_t POWERS_OF_10[] = {
+            1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL
+        };
+
+        /**
+         * Parses the digit run starting at p, eight bytes at a time while at
+         * least eight bytes remain, and advances p past it.
+         *
+         * @return false if the value does not fit in uint64_t
+         */
+        inline bool parse_number(const char*& p, const char* end, uint64_t& value) {
+            while (p < end && *p == '0') ++p;
+            const char* start = p;
+            value = 0;
+
+            while (end - p >= 8) {
+                uint64_t word;
+                std::memcpy(&word, p, sizeof(word));
+                uint64_t digits = word ^ (0x30 * ONES);
+                uint64_t mask = non_digit_mask(digits);
+
+                if (mask == 0) {
+                    value = value * POWERS_OF_10[8] + parse_eight_digits(digits);
+                    p += 8;
+                    continue;
+                }
+
+                unsigned length = static_cast<unsigned>(__builtin_ctzll(mask)) / 8;
+                if (length > 0) {
+                    // Shift the digits into the high bytes so the low bytes act as leading zeros
+                    digits <<= (8 - length) * 8;
+                    value = value * POWERS_OF_10[length] + parse_eight_digits(digits);
+                    p += length;
+                }
+                return fits_in_uint64(start, p);
+            }
+
+            while (p < end && is_digit(*p)) {
+                value = value * 10 + static_cast<uint64_t>(*p - '0');
+                ++p;
+            }
+            return fits_in_uint64(start, p);
+        }
+
+        // ========================================================================
+        // Integer printing
+        // ========================================================================
+
+        struct DigitPairs {
+            char data[200];
+
+            constexpr DigitPairs() : data{} {
+                for (int i = 0; i < 100; ++i) {
+                    data[2 * i] = static_cast<char>('0' + i / 10);
+                    data[2 * i + 1] = static_cast<char>('0' + i % 10);
+                }
+            }
+        };
+
+        constexpr DigitPairs DIGIT_PAIRS{};
+
+        // Thresholds for digit counting; the leading 0 makes zero count as one digit
+        constexpr uint64_t DIGIT_THRESHOLDS[] = {
+            0ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+            100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL,
+            10000000000000ULL, 100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL,
+            100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+        };
+
+        constexpr unsigned count_digits(uint64_t value) {
+            // log10(2) ~= 1233 / 4096 turns the bit length into a digit count estimate
+            unsigned estimate = static_cast<unsigned>(64 - __builtin_clzll(value | 1)) * 1233 >> 12;
+            return estimate + 1 - (value < DIGIT_THRESHOLDS[estimate]);
+        }
+
+        /**
+         * Checks count_digits on both sides of every power of ten.
+         */
+        constexpr bool count_digits_matches_boundaries() {
+            if (count_digits(0) != 1 || count_digits(UINT64_MAX) != 20) {
+                return false;
+            }
+            uint64_t power = 1;
+            for (unsigned digits = 1; digits < 20; ++digits) {
+                power *= 10;
+                if (count_digits(power - 1) != digits || count_digits(power) != digits + 1) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        static_assert(count_digits_matches_boundaries(), "count_digits is off at a power of ten");
+
+        /**
+         * Writes value in decimal, two digits per step from the end, and
+         * returns the position just past it.
+         */
+        inline char* write_number(char* out, uint64_t value) {
+            unsigned length = count_digits(value);
+            char* p = out + length;
+
+            while (value >= 100) {
+                unsigned pair = static_cast<unsigned>(value % 100);
+                value /= 100;
+                p -= 2;
+                std::memcpy(p, DIGIT_PAIRS.data + 2 * pair, 2);
+            }
+            if (value >= 10) {
+                std::memcpy(p - 2, DIGIT_PAIRS.data + 2 * value, 2);
+            } else {
+                p[-1] = static_cast<char>('0' + value);
+            }
+            return out + length;
+        }
+
+        inline char* write_missing(char* out) {
+            out[0] = '-';
+            out[1] = '1';
+            return out + 2;
+        }
+
+        // ========================================================================
+        // Operations
+        // ========================================================================
+
+        /**
+         * Position of value in FIBONACCI_TABLE, or -1. Returns 1 for the value 1
+         * to match fibonacci_position().
+         */
+        inline int table_position(uint64_t value) {
+            auto it = std::lower_bound(FIBONACCI_TABLE.begin(), FIBONACCI_TABLE.end(), value);
+            if (it == FIBONACCI_TABLE.end() || *it != value) {
+                return -1;
+            }
+            return static_cast<int>(it - FIBONACCI_TABLE.begin());
+        }
+
+        inline char* write_result(char* out, const BatchOptions& options, uint64_t value) {
+            switch (options.operation) {
+                case BatchOperation::VALUE:
+                    out = value <= MAX_FIBONACCI_INDEX ? write_number(out, FIBONACCI_TABLE[value])
+                                                       : write_missing(out);
+                    break;
+                case BatchOperation::MEMBERSHIP:
+                    *out++ = table_position(value) >= 0 ? '1' : '0';
+                    break;
+                case BatchOperation::POSITION: {
+                    int position = table_position(value);
+                    out = position >= 0 ? write_number(out, static_cast<uint64_t>(position))
+                                        : write_missing(out);
+                    break;
+                }
+                case BatchOperation::MODULO:
+                    out = write_number(out, fibonacci_mod(value, options.modulus));
+                    break;
+            }
+            *out++ = '\n';
+            return out;
+        }
+
+        void write_all(int fd, const char* data, size_t length) {
+            while (length > 0) {
+                ssize_t written = ::write(fd, data, length);
+                if (written < 0) {
+                    if (errno == EINTR) continue;
+                    throw std::runtime_error(std::string("write failed: ") + std::strerror(errno));
+                }
+                data += written;
+                length -= static_cast<size_t>(written);
+            }
+        }
+
+        // ========================================================================
+        // Block processing
+        // ========================================================================
+
+        /**
+         * Splits each input block into one range per thread, computes every
+         * range into its own output buffer in parallel, then writes the buffers
+         * to stdout in order.
+         */
+        class BlockProcessor {
+        public:
+            BlockProcessor(const BatchOptions& options, unsigned threads)
+                : options_(options), outputs_(threads), used_(threads), errors_(threads) {
+            }
+
+            /**
+             * Processes a prefix of [data, data + length) that ends on a value
+             * boundary, or all of it when final is set.
+             *
+             * @return Number of bytes consumed
+             */
+            size_t consume(const char* data, size_t length, bool final) {
+                size_t cut = final ? length : boundaryBefore(data, length);
+                if (cut == 0 && !final && !options_.binary_input) {
+                    // The block is a single run with no separator. Its leading zeros
+                    // can be dropped without changing the value; the last one is kept
+                    // so an all-zero run still reads as 0.
+                    size_t zeros = 0;
+                    while (zeros + 1 < length && data[zeros] == '0') ++zeros;
+                    if (zeros > 0) {
+                        bytes_ += zeros;
+                        return zeros;
+                    }
+                    // Anything else this long is not a valid value; parsing reports it
+                    cut = length;
+                }
+                if (options_.binary_input && cut % sizeof(uint64_t) != 0) {
+                    throw std::runtime_error("binary input is not a multiple of 8 bytes");
+                }
+                if (cut == 0) {
+                    return 0;
+                }
+
+                size_t ranges = std::min<size_t>(outputs_.size(), std::max<size_t>(1, cut / MIN_RANGE_SIZE));
+                std::vector<size_t> bounds(ranges + 1, cut);
+                bounds[0] = 0;
+                for (size_t i = 1; i < ranges; ++i) {
+                    bounds[i] = std::max(bounds[i - 1], boundaryAfter(data, cut, cut / ranges * i));
+                }
+
+                std::vector<std::thread> workers;
+                try {
+                    for (size_t i = 1; i < ranges; ++i) {
+                        workers.emplace_back(&BlockProcessor::processRange, this, i, data + bounds[i], data + bounds[i + 1]);
+                    }
+                } catch (...) {
+                    for (auto& worker : workers) {
+                        worker.join();
+                    }
+                    throw;
+                }
+                processRange(0, data + bounds[0], data + bounds[1]);
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+
+                // Results before the first bad value are still written, in order
+                for (size_t i = 0; i < ranges; ++i) {
+                    write_all(STDOUT_FILENO, outputs_[i].data(), used_[i]);
+                    if (errors_[i]) {
+                        std::rethrow_exception(errors_[i]);
+                    }
+                }
+
+                bytes_ += cut;
+                return cut;
+            }
+
+            uint64_t bytes() const { return bytes_; }
+
+        private:
+            /**
+             * Largest prefix length that does not split a value, or 0 if the
+             * block has no separator.
+             */
+            size_t boundaryBefore(const char* data, size_t length) const {
+                if (options_.binary_input) {
+                    return length - length % sizeof(uint64_t);
+                }
+                for (size_t i = length; i > 0; --i) {
+                    if (is_separator(data[i - 1])) {
+                        return i;
+                    }
+                }
+                return 0;
+            }
+
+            /**
+             * First value boundary at or after position, within [0, length].
+             */
+            size_t boundaryAfter(const char* data, size_t length, size_t position) const {
+                if (options_.binary_input) {
+                    return position - position % sizeof(uint64_t);
+                }
+                while (position < length && position > 0 && !is_separator(data[position - 1])) {
+                    ++position;
+                }
+                return position;
+            }
+
+            /**
+             * Runs computeRange, keeping any error for consume() to rethrow
+             * once every worker has been joined.
+             */
+            void processRange(size_t index, const char* begin, const char* end) {
+                errors_[index] = nullptr;
+                used_[index] = 0;
+                try {
+                    computeRange(index, begin, end);
+                } catch (...) {
+                    errors_[index] = std::current_exception();
+                }
+            }
+
+            void computeRange(size_t index, const char* begin, const char* end) {
+                std::vector<char>& out = outputs_[index];
+                size_t& used = used_[index];
+
+                auto reserve = [&out, &used] {
+                    if (out.size() - used < MAX_RESULT_LENGTH) {
+                        out.resize(std::max<size_t>(out.size() * 2, 64 * 1024));
+                    }
+                };
+
+                if (options_.binary_input) {
+                    for (const char* p = begin; p < end; p += sizeof(uint64_t)) {
+                        uint64_t value;
+                        std::memcpy(&value, p, sizeof(value));
+                        reserve();
+                        used = static_cast<size_t>(write_result(out.data() + used, options_, value) - out.data());
+                    }
+                } else {
+                    const char* p = begin;
+                    while (true) {
+                        while (p < end && is_separator(*p)) ++p;
+                        if (p == end) break;
+                        if (!is_digit(*p)) {
+                            throw_unexpected_character(*p);
+                        }
+
+                        uint64_t value;
+                        if (!parse_number(p, end, value)) {
+                            throw std::runtime_error(OUT_OF_RANGE_MESSAGE);
+                        }
+                        if (p < end && !is_separator(*p)) {
+                            throw_unexpected_character(*p);
+                        }
+
+                        reserve();
+                        used = static_cast<size_t>(write_result(out.data() + used, options_, value) - out.data());
+                    }
+                }
+            }
+
+            const BatchOptions& options_;
+            std::vector<std::vector<char>> outputs_;
+            std::vector<size_t> used_;
+            std::vector<std::exception_ptr> errors_;
+            uint64_t bytes_ = 0;
+        };
+
+        // ========================================================================
+        // Input sources
+        // ========================================================================
+
+        /**
+         * Maps the file and feeds it to the processor a block at a time,
+         * starting at the current file offset so a partly read stdin is
+         * picked up where the previous reader stopped.
+         *
+         * @return false if the file cannot be mapped and must be read instead
+         */
+        bool process_mapped(int fd, BlockProcessor& processor) {
+            struct stat info;
+            if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) {
+                return false;
+            }
+
+            off_t position = lseek(fd, 0, SEEK_CUR);
+            if (position < 0) {
+                return false;
+            }
+
+            size_t size = static_cast<size_t>(info.st_size);
+            size_t offset = static_cast<size_t>(position);
+            if (offset >= size) {
+                return true;
+            }
+
+            void* mapping = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                return false;
+            }
+            madvise(mapping, size, MADV_SEQUENTIAL);
+
+            const char* data = static_cast<const char*>(mapping);
+            try {
+                while (offset < size) {
+                    size_t length = std::min(BLOCK_SIZE, size - offset);
+                    offset += processor.consume(data + offset, length, offset + length == size);
+                }
+            } catch (...) {
+                munmap(mapping, size);
+                throw;
+            }
+            munmap(mapping, size);
+
+            // Leave the offset after the consumed input, as reading would
+            lseek(fd, static_cast<off_t>(size), SEEK_SET);
+            return true;
+        }
+
+        /**
+         * Reads a pipe or terminal in full blocks, carrying any partial value
+         * over to the next block.
+         */
+        void process_stream(int fd, BlockProcessor& processor) {
+            std::vector<char> buffer(BLOCK_SIZE);
+            size_t filled = 0;
+
+            while (true) {
+                ssize_t count = ::read(fd, buffer.data() + filled, buffer.size() - filled);
+                if (count < 0) {
+                    if (errno == EINTR) continue;
+                    throw std::runtime_error(std::string("read failed: ") + std::strerror(errno));
+                }
+                if (count == 0) {
+                    processor.consume(buffer.data(), filled, true);
+                    return;
+                }
+
+                filled += static_cast<size_t>(count);
+                if (filled == buffer.size()) {
+                    size_t consumed = processor.consume(buffer.data(), filled, false);
+                    std::memmove(buffer.data(), buffer.data() + consumed, filled - consumed);
+                    filled -= consumed;
+                }
+            }
+        }
+
+        // ========================================================================
+        // Reference iostream path
+        // ========================================================================
+
+        /**
+         * Pass-through stream buffer that counts the bytes read from its source
+         * so the iostream path can report the same throughput figure.
+         */
+        class CountingInputBuffer : public std::streambuf {
+        public:
+            explicit CountingInputBuffer(std::streambuf* source) : source_(source) {
+            }
+
+            uint64_t count() const { return count_; }
+
+        protected:
+            int_type underflow() override {
+                std::streamsize read = source_->sgetn(buffer_, sizeof(buffer_));
+                if (read <= 0) {
+                    return traits_type::eof();
+                }
+                count_ += static_cast<uint64_t>(read);
+                setg(buffer_, buffer_, buffer_ + read);
+                return traits_type::to_int_type(buffer_[0]);
+            }
+
+        private:
+            std::streambuf* source_;
+            char buffer_[64 * 1024];
+            uint64_t count_ = 0;
+        };
+
+        void print_result(std::ostream& out, const BatchOptions& options, uint64_t value) {
+            switch (options.operation) {
+                case BatchOperation::VALUE:
+                    if (value <= MAX_FIBONACCI_INDEX) {
+                        out << FIBONACCI_TABLE[value] << "\n";
+                    } else {
+                        out << -1 << "\n";
+                    }
+                    break;
+                case BatchOperation::MEMBERSHIP:
+                    out << (table_position(value) >= 0 ? 1 : 0) << "\n";
+                    break;
+                case BatchOperation::POSITION:
+                    out << table_position(value) << "\n";
+                    break;
+                case BatchOperation::MODULO:
+                    out << fibonacci_mod(value, options.modulus) << "\n";
+                    break;
+            }
+        }
+
+        uint64_t run_iostream(const BatchOptions& options) {
+            std::ios::sync_with_stdio(false);
+
+            std::ifstream file;
+            std::streambuf* source = std::cin.rdbuf();
+            if (!options.input_path.empty() && options.input_path != "-") {
+                file.open(options.input_path, std::ios::binary);
+                if (!file) {
+                    throw std::runtime_error("cannot open " + options.input_path);
+                }
+                source = file.rdbuf();
+            }
+
+            CountingInputBuffer counter(source);
+            std::istream in(&counter);
+            uint64_t value;
+
+            if (options.binary_input) {
+                while (in.read(reinterpret_cast<char*>(&value), sizeof(value))) {
+                    print_result(std::cout, options, value);
+                }
+                if (in.gcount() != 0) {
+                    throw std::runtime_error("binary input is not a multiple of 8 bytes");
+                }
+            } else {
+                // Mirrors the fast path: the same separators, and the same errors
+                // for anything else
+                using traits = std::istream::traits_type;
+                while (true) {
+                    traits::int_type next = in.peek();
+                    while (next != traits::eof() && is_separator(traits::to_char_type(next))) {
+                        in.get();
+                        next = in.peek();
+                    }
+                    if (next == traits::eof()) break;
+                    if (!is_digit(traits::to_char_type(next))) {
+                        throw_unexpected_character(traits::to_char_type(next));
+                    }
+
+                    if (!(in >> value)) {
+                        throw std::runtime_error(OUT_OF_RANGE_MESSAGE);
+                    }
+                    next = in.peek();
+                    if (next != traits::eof() && !is_separator(traits::to_char_type(next))) {
+                        throw_unexpected_character(traits::to_char_type(next));
+                    }
+
+                    print_result(std::cout, options, value);
+                }
+            }
+
+            std::cout.flush();
+            return counter.count();
+        }
+
+        uint64_t run_fast(const BatchOptions& options) {
+            unsigned threads = options.threads;
+            if (threads == 0) {
+                threads = std::max(1u, std::thread::hardware_concurrency());
+            }
+            BlockProcessor processor(options, threads);
+
+            int fd = STDIN_FILENO;
+            if (!options.input_path.empty() && options.input_path != "-") {
+                fd = ::open(options.input_path.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    throw std::runtime_error("cannot open " + options.input_path + ": " + std::strerror(errno));
+                }
+            }
+
+            try {
+                if (!process_mapped(fd, processor)) {
+                    process_stream(fd, processor);
+                }
+            } catch (...) {
+                if (fd != STDIN_FILENO) ::close(fd);
+                throw;
+            }
+            if (fd != STDIN_FILENO) ::close(fd);
+
+            return processor.bytes();
+        }
+
+        uint64_t parse_unsigned(const std::string& text, const std::string& option) {
+            if (text.empty() || !std::all_of(text.begin(), text.end(), is_digit)) {
+                throw std::invalid_argument(option + " expects a non-negative integer, got '" + text + "'");
+            }
+            try {
+                return std::stoull(text);
+            } catch (const std::out_of_range&) {
+                throw std::invalid_argument(option + " value is out of range: " + text);
+            }
+        }
+
+    } // namespace
+
+    BatchOptions parse_batch_options(int argc, char** argv) {
+        BatchOptions options;
+        bool have_operation = false;
+
+        for (int i = 0; i < argc; ++i) {
+            std::string arg = argv[i];
+
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc) {
+                    throw std::invalid_argument(arg + " requires a value");
+                }
+                return argv[++i];
+            };
+
+            if (arg == "--mod") {
+                options.modulus = parse_unsigned(next(), arg);
+            } else if (arg == "--threads") {
+                uint64_t threads = parse_unsigned(next(), arg);
+                if (threads > MAX_THREADS) {
+                    throw std::invalid_argument(arg + " must be at most " + std::to_string(MAX_THREADS));
+                }
+                options.threads = static_cast<unsigned>(threads);
+            } else if (arg == "--binary") {
+                options.binary_input = true;
+            } else if (arg == "--iostream") {
+                options.use_iostream = true;
+            } else if (arg == "--stats") {
+                options.report_stats = true;
+            } else if (!have_operation) {
+                if (arg == "fib") {
+                    options.operation = BatchOperation::VALUE;
+                } else if (arg == "is-fib") {
+                    options.operation = BatchOperation::MEMBERSHIP;
+                } else if (arg == "position") {
+                    options.operation = BatchOperation::POSITION;
+                } else if (arg == "mod") {
+                    options.operation = BatchOperation::MODULO;
+                } else {
+                    throw std::invalid_argument("unknown operation '" + arg + "'");
+                }
+                have_operation = true;
+            } else if (options.input_path.empty() && (arg == "-" || arg.rfind("--", 0) != 0)) {
+                options.input_path = arg;
+            } else {
+                throw std::invalid_argument("unexpected argument '" + arg + "'");
+            }
+        }
+
+        if (!have_operation) {
+            throw std::invalid_argument("missing operation");
+        }
+        if (options.operation == BatchOperation::MODULO && options.modulus == 0) {
+            throw std::invalid_argument("mod requires a non-zero --mod value");
+        }
+        return options;
+    }
+
+    void run_batch(const BatchOptions& options) {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t bytes = options.use_iostream ? run_iostream(options) : run_fast(options);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        if (options.report_stats) {
+            double megabytes = static_cast<double>(bytes) / 1e6;
+            std::cerr << (options.use_iostream ? "iostream" : "fast") << " path: "
+                      << megabytes << " MB in " << elapsed.count() << " s ("
+                      << (elapsed.count() > 0 ? megabytes / elapsed.count() : 0.0) << " MB/s)\n";
+        }
+    }
+
+    const char* batch_usage() {
+        return "Usage: fibonacci --batch OPERATION [options] [FILE]\n"
+               "\n"
+               "Reads numbers from FILE (or stdin when FILE is missing or '-') and\n"
+               "prints one result per line, in input order. Values are integers from\n"
+               "0 to 18446744073709551615 separated by whitespace, commas or\n"
+               "semicolons; anything else is an error.\n"
+               "\n"
+               "Operations:\n"
+               "  fib          F(n), or -1 when it does not fit in 64 bits\n"
+               "  is-fib       1 if the number is a Fibonacci number, 0 otherwise\n"
+               "  position     Position of the number in the sequence, or -1\n"
+               "  mod          F(n) mod M, requires --mod M\n"
+               "\n"
+               "Options:\n"
+               "  --mod M      Modulus for the mod operation\n"
+               "  --binary     Input is raw native-endian uint64 values\n"
+               "  --threads N  Worker threads, at most 1024 (default: hardware concurrency)\n"
+               "  --iostream   Use the reference iostream implementation\n"
+               "  --stats      Print throughput to stderr\n";
+    }
+
+} // namespace Fibonacci
@@ -0,0 +1,66 @@
+/**
+ * @file fibonacci_batch.h
+ * @author Ahmed Al-Mansouri (ahmed@bridgesforpeace.org)
+ * @brief Streaming batch mode for the fibonacci program
+ * @date 2026-10-18
+ *
+ * @copyright Copyright Bridges for Peace (c) 2025
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace Fibonacci {
+
+    /**
+     * @brief Operation applied to every input value in batch mode
+     */
+    enum class BatchOperation {
+        VALUE,       // F(n), or -1 when F(n) does not fit in uint64_t
+        MEMBERSHIP,  // 1 if the value is a Fibonacci number, 0 otherwise
+        POSITION,    // Position of the value in the sequence, or -1
+        MODULO       // F(n) mod m
+    };
+
+    /**
+     * @brief Settings for a batch run, normally parsed from the command line
+     */
+    struct BatchOptions {
+        BatchOperation operation = BatchOperation::VALUE;
+        uint64_t modulus = 0;
+        bool binary_input = false;   // Raw native-endian uint64 values instead of text
+        bool use_iostream = false;   // Reference iostream path, for comparison
+        bool report_stats = false;   // Print throughput to stderr
+        unsigned threads = 0;        // 0 uses the hardware concurrency; at most 1024
+        std::string input_path;      // Empty or "-" reads stdin
+    };
+
+    /**
+     * @brief Parses the arguments that follow --batch
+     *
+     * @throws std::invalid_argument on unknown or malformed arguments
+     */
+    BatchOptions parse_batch_options(int argc, char** argv);
+
+    /**
+     * @brief Streams every input value through the requested operation
+     *
+     * Text input is a sequence of non-negative decimal numbers separated
+     * by whitespace, commas or semicolons. Results are written to stdout,
+     * one per line, in input order. Regular files are memory-mapped from
+     * the current offset; pipes are read in large blocks.
+     *
+     * @throws std::runtime_error on I/O failures, truncated binary input,
+     *         values that do not fit in uint64_t, or any other character
+     *         in text input
+     */
+    void run_batch(const BatchOptions& options);
+
+    /**
+     * @brief Usage text for batch mode
+     */
+    const char* batch_usage();
+
+} // namespace Fibonacci
@@ -101,6 +101,269 @@ namespace ModernHelloWorld {
         return formatter_type_;
     }
 
+    // ============================================================================
+    // PhaseError Implementation
+    // ============================================================================
+
+    PhaseError::PhaseError(const std::string& phase, const std::string& message)
+        : std::runtime_error(message), phase_(phase) {
+    }
+
+    const std::string& PhaseError::phase() const noexcept {
+        return phase_;
+    }
+
+    PhaseCancelled::PhaseCancelled(const std::string& phase)
+        : std::runtime_error("Phase '" + phase + "' was cancelled") {
+    }
+
+    // ============================================================================
+    // TaskGraph Implementation
+    // ============================================================================
+
+    TaskGraph::TaskGraph(size_t workers) : workers_(workers) {
+    }
+
+    void TaskGraph::addTask(const std::string& name, const std::vector<std::string>& dependencies, Task task) {
+        auto find = [this](const std::string& wanted) {
+            return std::find_if(nodes_.begin(), nodes_.end(),
+                                [&wanted](const Node& node) { return node.name == wanted; });
+        };
+
+        if (find(name) != nodes_.end()) {
+            throw std::invalid_argument("Duplicate task: " + name);
+        }
+
+        Node node;
+        node.name = name;
+        node.task = std::move(task);
+        for (const auto& dependency : dependencies) {
+            auto it = find(dependency);
+            if (it == nodes_.end()) {
+                throw std::invalid_argument("Task '" + name + "' depends on unknown task '" + dependency + "'");
+            }
+            size_t index = static_cast<size_t>(it - nodes_.begin());
+            node.dependencies.push_back(index);
+            it->dependents.push_back(nodes_.size());
+        }
+        nodes_.push_back(std::move(node));
+    }
+
+    void TaskGraph::run() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ready_.clear();
+            settled_ = 0;
+            error_ = nullptr;
+            failed_task_.clear();
+            for (size_t i = 0; i < nodes_.size(); ++i) {
+                nodes_[i].state = TaskState::PENDING;
+                nodes_[i].remaining = nodes_[i].dependencies.size();
+                if (nodes_[i].remaining == 0) {
+                    ready_.push_back(i);
+                }
+            }
+            if (cancelled_) {
+                settlePendingLocked();
+            }
+            started_ = Clock::now();
+        }
+
+        std::vector<std::thread> pool;
+        size_t threads = workers_ == 0 ? nodes_.size() : std::min(workers_, nodes_.size());
+        try {
+            for (size_t i = 0; i < threads; ++i) {
+                pool.emplace_back(&TaskGraph::workerLoop, this);
+            }
+        } catch (...) {
+            // Let the workers that did start finish their current task and exit
+            cancel();
+            for (auto& worker : pool) {
+                worker.join();
+            }
+            finished_ = Clock::now();
+            throw;
+        }
+        for (auto& worker : pool) {
+            worker.join();
+        }
+        finished_ = Clock::now();
+
+        if (error_) {
+            try {
+                std::rethrow_exception(error_);
+            } catch (const std::exception& e) {
+                throw PhaseError(failed_task_, e.what());
+            } catch (...) {
+                throw PhaseError(failed_task_, "unknown error");
+            }
+        }
+    }
+
+    void TaskGraph::workerLoop() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this] { return !ready_.empty() || settled_ == nodes_.size(); });
+            if (ready_.empty()) {
+                return;
+            }
+
+            size_t index = ready_.front();
+            ready_.pop_front();
+            Node& node = nodes_[index];
+            node.state = TaskState::RUNNING;
+            node.start = Clock::now();
+            lock.unlock();
+
+            std::exception_ptr error;
+            bool stopped = false;
+            try {
+                node.task();
+            } catch (const PhaseCancelled&) {
+                stopped = true;
+            } catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            node.end = Clock::now();
+            ++settled_;
+
+            bool newly_cancelled = false;
+            if (error) {
+                node.state = TaskState::FAILED;
+                if (!error_) {
+                    error_ = error;
+                    failed_task_ = node.name;
+                }
+                newly_cancelled = cancelLocked();
+            } else if (stopped) {
+                // Dependents can no longer run, so settle them with the rest
+                node.state = TaskState::CANCELLED;
+                newly_cancelled = cancelLocked();
+            } else {
+                node.state = TaskState::DONE;
+                for (size_t dependent : node.dependents) {
+                    Node& next = nodes_[dependent];
+                    if (--next.remaining == 0 && next.state == TaskState::PENDING) {
+                        ready_.push_back(dependent);
+                    }
+                }
+            }
+            cv_.notify_all();
+
+            std::function<void()> handler = newly_cancelled ? cancel_handler_ : nullptr;
+            if (handler) {
+                lock.unlock();
+                handler();
+                lock.lock();
+            }
+        }
+    }
+
+    bool TaskGraph::cancelLocked() {
+        if (cancelled_) {
+            return false;
+        }
+        cancelled_ = true;
+        settlePendingLocked();
+        return true;
+    }
+
+    void TaskGraph::settlePendingLocked() {
+        ready_.clear();
+        for (auto& node : nodes_) {
+            if (node.state == TaskState::PENDING) {
+                node.state = TaskState::CANCELLED;
+                ++settled_;
+            }
+        }
+    }
+
+    void TaskGraph::cancel() {
+        std::function<void()> handler;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (cancelLocked()) {
+                handler = cancel_handler_;
+            }
+        }
+        cv_.notify_all();
+        if (handler) {
+            handler();
+        }
+    }
+
+    void TaskGraph::onCancel(std::function<void()> handler) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cancel_handler_ = std::move(handler);
+    }
+
+    std::chrono::microseconds TaskGraph::durationOf(const Node& node) const {
+        if (node.state != TaskState::DONE && node.state != TaskState::FAILED) {
+            return std::chrono::microseconds::zero();
+        }
+        return std::chrono::duration_cast<std::chrono::microseconds>(node.end - node.start);
+    }
+
+    std::vector<TaskGraph::TaskReport> TaskGraph::report() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<TaskReport> result;
+        result.reserve(nodes_.size());
+        for (const auto& node : nodes_) {
+            auto start = std::chrono::microseconds::zero();
+            if (node.state == TaskState::DONE || node.state == TaskState::FAILED) {
+                start = std::chrono::duration_cast<std::chrono::microseconds>(node.start - started_);
+            }
+            result.push_back({node.name, node.state, start, durationOf(node)});
+        }
+        return result;
+    }
+
+    bool TaskGraph::ran(const std::string& name) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::any_of(nodes_.begin(), nodes_.end(), [&name](const Node& node) {
+            return node.name == name &&
+                   (node.state == TaskState::DONE || node.state == TaskState::FAILED);
+        });
+    }
+
+    bool TaskGraph::completed() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::all_of(nodes_.begin(), nodes_.end(),
+                           [](const Node& node) { return node.state == TaskState::DONE; });
+    }
+
+    std::chrono::microseconds TaskGraph::wallTime() const {
+        return std::chrono::duration_cast<std::chrono::microseconds>(finished_ - started_);
+    }
+
+    std::chrono::microseconds TaskGraph::serialTime() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto total = std::chrono::microseconds::zero();
+        for (const auto& node : nodes_) {
+            total += durationOf(node);
+        }
+        return total;
+    }
+
+    std::chrono::microseconds TaskGraph::criticalPath() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Nodes are stored in a topological order since dependencies must be
+        // registered first, so a single forward pass finds the longest chain.
+        std::vector<std::chrono::microseconds> finish(nodes_.size());
+        auto longest = std::chrono::microseconds::zero();
+        for (size_t i = 0; i < nodes_.size(); ++i) {
+            auto before = std::chrono::microseconds::zero();
+            for (size_t dependency : nodes_[i].dependencies) {
+                before = std::max(before, finish[dependency]);
+            }
+            finish[i] = before + durationOf(nodes_[i]);
+            longest = std::max(longest, finish[i]);
+        }
+        return longest;
+    }
+
     // ============================================================================
     // HelloWorldApp Implementation
     // ============================================================================
@@ -110,27 +373,54 @@ namespace ModernHelloWorld {
     }
 
     void HelloWorldApp::run() {
+        std::cout << "🚀 Starting Modern Hello World Application...\n";
+
+        {
+            std::lock_guard<std::mutex> lock(cancel_mutex_);
+            cancelled_ = false;
+        }
+
+        TaskGraph graph;
+        graph.onCancel([this] {
+            {
+                std::lock_guard<std::mutex> lock(cancel_mutex_);
+                cancelled_ = true;
+            }
+            cancel_cv_.notify_all();
+        });
+
+        graph.addTask("initialize", {}, [this] { initialize(); });
+        graph.addTask("validate", {}, [this] { validateConfiguration(); });
+        graph.addTask("createFormatter", {}, [this] { createFormatter(); });
+        graph.addTask("display", {"initialize", "validate", "createFormatter"}, [this] { displayMessage(); });
+        graph.addTask("delay", {"display"}, [this] { performDelay(); });
+        graph.addTask("cleanup", {"display"}, [this] { cleanup(); });
+
         try {
-            std::cout << "🚀 Starting Modern Hello World Application...\n";
-            
-            initialize();
-            createFormatter();
-            displayMessage();
-            cleanup();
-            
-            std::cout << "✅ Application completed successfully!\n";
+            graph.run();
+            if (graph.completed()) {
+                std::cout << "✅ Application completed successfully!\n";
+            } else {
+                std::cout << "⚠️  Application was cancelled before completing\n";
+            }
+        } catch (const PhaseError& e) {
+            std::cerr << "❌ Error in phase '" << e.phase() << "': " << e.what() << std::endl;
         } catch (const std::exception& e) {
             std::cerr << "❌ Error: " << e.what() << std::endl;
         }
+
+        if (!graph.ran("cleanup")) {
+            cleanup();
+        }
+
+        reportTimings(graph);
     }
 
     void HelloWorldApp::initialize() {
         std::cout << "📋 Initializing application components...\n";
         
-        validateConfiguration();
-        
         // Simulate initialization delay
-        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        cancellableWait("initialize", std::chrono::milliseconds(500));
         
         std::cout << "✅ Initialization complete!\n";
     }
@@ -148,8 +438,6 @@ namespace ModernHelloWorld {
             std::string formatted = formatter_->format(message);
             std::cout << formatted << std::endl;
         }
-        
-        performDelay();
     }
 
     void HelloWorldApp::cleanup() {
@@ -165,19 +453,21 @@ namespace ModernHelloWorld {
         auto& config = ConfigManager::getInstance();
         formatter_ = MessageFactory::createFormatter(config.getFormatterType());
         
-        std::cout << "🔧 Created formatter of type: ";
+        // Build the line first so it is written in one piece while other
+        // phases print concurrently
+        std::string line = "🔧 Created formatter of type: ";
         switch (config.getFormatterType()) {
             case MessageFactory::MessageType::SIMPLE:
-                std::cout << "Simple";
+                line += "Simple";
                 break;
             case MessageFactory::MessageType::DECORATED:
-                std::cout << "Decorated";
+                line += "Decorated";
                 break;
             case MessageFactory::MessageType::ANIMATED:
-                std::cout << "Animated";
+                line += "Animated";
                 break;
         }
-        std::cout << "\n";
+        std::cout << line + "\n";
     }
 
     void HelloWorldApp::validateConfiguration() const {
@@ -194,16 +484,63 @@ namespace ModernHelloWorld {
         std::cout << "✅ Configuration validation passed!\n";
     }
 
-    void HelloWorldApp::performDelay() const {
+    void HelloWorldApp::performDelay() {
         auto& config = ConfigManager::getInstance();
         int delay = config.getDelay();
         
         if (delay > 0) {
-            std::cout << "⏳ Waiting for " << delay << "ms...\n";
-            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            std::cout << "⏳ Waiting for " + std::to_string(delay) + "ms...\n";
+            cancellableWait("delay", std::chrono::milliseconds(delay));
         }
     }
 
+    void HelloWorldApp::cancellableWait(const std::string& phase, std::chrono::milliseconds duration) {
+        std::unique_lock<std::mutex> lock(cancel_mutex_);
+        if (cancel_cv_.wait_for(lock, duration, [this] { return cancelled_; })) {
+            throw PhaseCancelled(phase);
+        }
+    }
+
+    void HelloWorldApp::reportTimings(const TaskGraph& graph) const {
+        auto toMs = [](std::chrono::microseconds us) { return us.count() / 1000.0; };
+
+        std::ostringstream ss;
+        ss << std::fixed << std::setprecision(1);
+        ss << "\n⏱️  Phase timings:\n";
+        for (const auto& task : graph.report()) {
+            ss << "  " << std::left << std::setw(16) << task.name << std::right;
+            switch (task.state) {
+                case TaskGraph::TaskState::DONE:
+                case TaskGraph::TaskState::FAILED:
+                    ss << " start " << std::setw(8) << toMs(task.start) << " ms"
+                       << "  took " << std::setw(8) << toMs(task.duration) << " ms";
+                    if (task.state == TaskGraph::TaskState::FAILED) {
+                        ss << "  (failed)";
+                    }
+                    break;
+                default:
+                    ss << " cancelled";
+                    break;
+            }
+            ss << "\n";
+        }
+
+        auto serial = graph.serialTime();
+        ss << "  Sequential total: " << toMs(serial) << " ms\n";
+        ss << "  Wall time:        " << toMs(graph.wallTime()) << " ms\n";
+
+        // Timings of a failed or cancelled run say nothing about the schedule
+        if (graph.completed()) {
+            auto critical = graph.criticalPath();
+            ss << "  Critical path:    " << toMs(critical) << " ms\n";
+            if (critical.count() > 0) {
+                ss << "  Speedup:          " << std::setprecision(2)
+                   << static_cast<double>(serial.count()) / critical.count() << "x\n";
+            }
+        }
+        std::cout << ss.str();
+    }
+
     // ============================================================================
     // StringUtils Implementation
     // ============================================================================
@@ -250,6 +587,9 @@ namespace ModernHelloWorld {
 // Main Function
 // ============================================================================
 
+// Tests build this file with HELLOWORLD_NO_MAIN and provide their own main
+#ifndef HELLOWORLD_NO_MAIN
+
 int main() {
     using namespace ModernHelloWorld;
     
@@ -284,4 +624,6 @@ int main() {
     std::cout << "\n🎉 Thank you for using the Modern C++ Hello World Application!\n";
     
     return 0;
-} 
\ No newline at end of file
+}
+
+#endif // HELLOWORLD_NO_MAIN
@@ -12,6 +12,9 @@
 #include <future>
 #include <mutex>
 #include <condition_variable>
+#include <deque>
+#include <exception>
+#include <stdexcept>
 
 namespace ModernHelloWorld {
 
@@ -106,6 +109,138 @@ namespace ModernHelloWorld {
         MessageFactory::MessageType formatter_type_ = MessageFactory::MessageType::DECORATED;
     };
 
+    /**
+     * @brief Error raised when a lifecycle phase fails
+     * 
+     * Carries the name of the failing phase alongside the original message.
+     */
+    class PhaseError : public std::runtime_error {
+    public:
+        PhaseError(const std::string& phase, const std::string& message);
+        const std::string& phase() const noexcept;
+
+    private:
+        std::string phase_;
+    };
+
+    /**
+     * @brief Thrown by a phase that stopped early because the run was cancelled
+     * 
+     * The task graph records such a phase as cancelled rather than failed,
+     * and cancels the tasks that have not started yet.
+     */
+    class PhaseCancelled : public std::runtime_error {
+    public:
+        explicit PhaseCancelled(const std::string& phase);
+    };
+
+    /**
+     * @brief Dependency-aware task graph executor
+     * 
+     * Tasks declare the tasks they depend on. Every task whose dependencies
+     * have completed runs on a shared pool of worker threads, so independent
+     * phases overlap. The first failure cancels all tasks that have not
+     * started yet and is rethrown from run() as a PhaseError.
+     */
+    class TaskGraph {
+    public:
+        using Task = std::function<void()>;
+        using Clock = std::chrono::steady_clock;
+
+        enum class TaskState {
+            PENDING,
+            RUNNING,
+            DONE,
+            FAILED,
+            CANCELLED
+        };
+
+        struct TaskReport {
+            std::string name;
+            TaskState state;
+            std::chrono::microseconds start;
+            std::chrono::microseconds duration;
+        };
+
+        /**
+         * @param workers Size of the worker pool; 0 uses one worker per task,
+         *                which suits phases that mostly wait rather than compute
+         */
+        explicit TaskGraph(size_t workers = 0);
+
+        /**
+         * @brief Registers a task
+         * 
+         * Dependencies must already be registered, which keeps the graph acyclic.
+         */
+        void addTask(const std::string& name, const std::vector<std::string>& dependencies, Task task);
+
+        /**
+         * @brief Runs all tasks and blocks until every task has settled
+         * 
+         * @throws PhaseError if any task threw
+         * @throws std::system_error if a worker thread cannot be started
+         */
+        void run();
+
+        /**
+         * @brief Cancels every task that has not started yet
+         * 
+         * Stays in effect: tasks of a cancelled graph never start, including
+         * in a run() that begins after the call.
+         */
+        void cancel();
+
+        /**
+         * @brief Sets a callback invoked once when the graph is cancelled
+         * 
+         * Lets running tasks interrupt their own waits.
+         */
+        void onCancel(std::function<void()> handler);
+
+        std::vector<TaskReport> report() const;
+        bool ran(const std::string& name) const;
+
+        /**
+         * @brief Whether every task of the last run completed
+         */
+        bool completed() const;
+
+        std::chrono::microseconds wallTime() const;
+        std::chrono::microseconds serialTime() const;
+        std::chrono::microseconds criticalPath() const;
+
+    private:
+        struct Node {
+            std::string name;
+            std::vector<size_t> dependencies;
+            std::vector<size_t> dependents;
+            Task task;
+            TaskState state = TaskState::PENDING;
+            size_t remaining = 0;
+            Clock::time_point start;
+            Clock::time_point end;
+        };
+
+        void workerLoop();
+        bool cancelLocked();
+        void settlePendingLocked();
+        std::chrono::microseconds durationOf(const Node& node) const;
+
+        size_t workers_;
+        std::vector<Node> nodes_;
+        std::deque<size_t> ready_;
+        size_t settled_ = 0;
+        bool cancelled_ = false;
+        std::exception_ptr error_;
+        std::string failed_task_;
+        std::function<void()> cancel_handler_;
+        Clock::time_point started_;
+        Clock::time_point finished_;
+        mutable std::mutex mutex_;
+        std::condition_variable cv_;
+    };
+
     /**
      * @brief Main Hello World application class
      * 
@@ -120,18 +255,22 @@ namespace ModernHelloWorld {
         /**
          * @brief Runs the Hello World application
          * 
-         * This method orchestrates the entire application flow:
-         * 1. Initializes the application
-         * 2. Creates the appropriate message formatter
-         * 3. Formats and displays the message
-         * 4. Performs cleanup operations
+         * This method orchestrates the entire application flow as a task graph:
+         * 1. Initializes the application, validates the configuration and
+         *    creates the message formatter in parallel
+         * 2. Formats and displays the message
+         * 3. Performs cleanup operations while the display delay elapses
+         * 
+         * A failing phase cancels the phases that have not started yet;
+         * cleanup still runs before the error is reported.
          */
         void run();
 
         /**
          * @brief Sets up the application environment
          * 
-         * Initializes various components and validates configuration.
+         * Initializes various components. Configuration is validated
+         * separately by validateConfiguration().
          */
         void initialize();
 
@@ -139,7 +278,8 @@ namespace ModernHelloWorld {
          * @brief Displays the formatted message
          * 
          * Uses the configured formatter to display the message
-         * with appropriate timing and effects.
+         * with appropriate effects. The trailing delay is performed
+         * separately by performDelay().
          */
         void displayMessage();
 
@@ -156,6 +296,11 @@ namespace ModernHelloWorld {
         std::condition_variable display_cv_;
         bool ready_to_display_ = false;
 
+        // Set when the running task graph is cancelled; wakes cancellableWait()
+        std::mutex cancel_mutex_;
+        std::condition_variable cancel_cv_;
+        bool cancelled_ = false;
+
         /**
          * @brief Creates the message formatter based on configuration
          * 
@@ -175,7 +320,20 @@ namespace ModernHelloWorld {
          * 
          * Uses modern C++ timing facilities for precise delays.
          */
-        void performDelay() const;
+        void performDelay();
+
+        /**
+         * @brief Sleeps for the given duration unless the run is cancelled
+         * 
+         * @throws PhaseCancelled if the wait was cut short by cancellation
+         */
+        void cancellableWait(const std::string& phase, std::chrono::milliseconds duration);
+
+        /**
+         * @brief Prints per-phase timings, and the critical-path speedup
+         *        when every phase completed
+         */
+        void reportTimings(const TaskGraph& graph) const;
     };
 
     /**
@@ -0,0 +1,220 @@
+/**
+ * @file TaskGraphTest.cpp
+ * @brief Checks for the TaskGraph executor and the HelloWorldApp lifecycle
+ *
+ * Built against HelloWorld.cpp with HELLOWORLD_NO_MAIN; see `make test-taskgraph`.
+ */
+
+#include "HelloWorld.h"
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include <unistd.h>
+
+using namespace ModernHelloWorld;
+
+namespace {
+
+    int failures = 0;
+
+    void check(bool condition, const std::string& what) {
+        if (!condition) {
+            std::cerr << "FAILED: " << what << "\n";
+            ++failures;
+        }
+    }
+
+    TaskGraph::TaskState stateOf(const TaskGraph& graph, const std::string& name) {
+        for (const auto& task : graph.report()) {
+            if (task.name == name) {
+                return task.state;
+            }
+        }
+        throw std::invalid_argument("no task " + name);
+    }
+
+    /**
+     * One-shot flag that a task can wait on with a timeout.
+     */
+    class Signal {
+    public:
+        void set() {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                set_ = true;
+            }
+            cv_.notify_all();
+        }
+
+        bool waitFor(std::chrono::milliseconds timeout) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            return cv_.wait_for(lock, timeout, [this] { return set_; });
+        }
+
+    private:
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        bool set_ = false;
+    };
+
+    void testDependencyOrder() {
+        TaskGraph graph;
+        std::mutex mutex;
+        std::vector<std::string> order;
+        auto record = [&](const std::string& name) {
+            std::lock_guard<std::mutex> lock(mutex);
+            order.push_back(name);
+        };
+
+        // b and c only finish if each sees the other start, so they must overlap
+        Signal b_started, c_started;
+        std::atomic<bool> overlapped{true};
+
+        graph.addTask("a", {}, [&] { record("a"); });
+        graph.addTask("b", {"a"}, [&] {
+            b_started.set();
+            overlapped = overlapped && c_started.waitFor(std::chrono::seconds(2));
+            record("b");
+        });
+        graph.addTask("c", {"a"}, [&] {
+            c_started.set();
+            overlapped = overlapped && b_started.waitFor(std::chrono::seconds(2));
+            record("c");
+        });
+        graph.addTask("d", {"b", "c"}, [&] { record("d"); });
+        graph.run();
+
+        check(order.size() == 4, "all four tasks ran");
+        check(!order.empty() && order.front() == "a", "a runs first");
+        check(!order.empty() && order.back() == "d", "d runs after b and c");
+        check(overlapped, "independent tasks b and c run in parallel");
+        check(graph.completed(), "graph reports completion");
+    }
+
+    void testFailureCancelsPendingAndWaitingTasks() {
+        TaskGraph graph;
+        Signal waiting_started, cancelled;
+        std::atomic<bool> dependent_ran{false};
+        graph.onCancel([&] { cancelled.set(); });
+
+        graph.addTask("waiting", {}, [&] {
+            waiting_started.set();
+            if (cancelled.waitFor(std::chrono::seconds(5))) {
+                throw PhaseCancelled("waiting");
+            }
+        });
+        graph.addTask("failing", {}, [&] {
+            waiting_started.waitFor(std::chrono::seconds(2));
+            throw std::runtime_error("boom");
+        });
+        graph.addTask("dependent", {"failing"}, [&] { dependent_ran = true; });
+
+        bool threw = false;
+        try {
+            graph.run();
+        } catch (const PhaseError& e) {
+            threw = true;
+            check(e.phase() == "failing", "PhaseError names the failing phase");
+            check(std::string(e.what()) == "boom", "PhaseError keeps the original message");
+        }
+
+        check(threw, "run() rethrows the failure as PhaseError");
+        check(!dependent_ran, "dependent of a failed task does not run");
+        check(stateOf(graph, "failing") == TaskGraph::TaskState::FAILED, "failed task is FAILED");
+        check(stateOf(graph, "dependent") == TaskGraph::TaskState::CANCELLED, "pending task is CANCELLED");
+        check(stateOf(graph, "waiting") == TaskGraph::TaskState::CANCELLED, "interrupted task is CANCELLED");
+        check(!graph.completed(), "failed graph does not report completion");
+    }
+
+    void testCancelledTaskSettlesDependents() {
+        TaskGraph graph;
+        graph.addTask("a", {}, [] { throw PhaseCancelled("a"); });
+        graph.addTask("b", {"a"}, [] {});
+        graph.run();
+
+        check(stateOf(graph, "a") == TaskGraph::TaskState::CANCELLED, "stopped task is CANCELLED");
+        check(stateOf(graph, "b") == TaskGraph::TaskState::CANCELLED, "its dependent is CANCELLED");
+        check(!graph.completed(), "graph with a stopped task does not report completion");
+    }
+
+    void testCancelBeforeRun() {
+        TaskGraph graph;
+        int handler_calls = 0;
+        bool ran = false;
+        graph.onCancel([&] { ++handler_calls; });
+        graph.addTask("a", {}, [&] { ran = true; });
+
+        graph.cancel();
+        graph.run();
+
+        check(!ran, "task of a graph cancelled before run() does not start");
+        check(stateOf(graph, "a") == TaskGraph::TaskState::CANCELLED, "it is reported as CANCELLED");
+        check(handler_calls == 1, "cancel handler runs once");
+    }
+
+    /**
+     * Runs the application with an empty message and checks that validation
+     * fails and cleanup still runs. Output goes through the real stdout and
+     * stderr, redirected to a file, since the phases print concurrently.
+     */
+    void testAppRunsCleanupAfterFailure() {
+        auto& config = ConfigManager::getInstance();
+        config.setMessage("");
+        config.setDelay(0);
+
+        char path[] = "/tmp/taskgraph_test_XXXXXX";
+        int fd = mkstemp(path);
+        check(fd >= 0, "temporary output file can be created");
+        if (fd < 0) return;
+
+        std::cout.flush();
+        std::cerr.flush();
+        int saved_out = dup(STDOUT_FILENO);
+        int saved_err = dup(STDERR_FILENO);
+        dup2(fd, STDOUT_FILENO);
+        dup2(fd, STDERR_FILENO);
+
+        HelloWorldApp app;
+        app.run();
+
+        std::cout.flush();
+        std::cerr.flush();
+        std::fflush(nullptr);
+        dup2(saved_out, STDOUT_FILENO);
+        dup2(saved_err, STDERR_FILENO);
+        close(saved_out);
+        close(saved_err);
+        close(fd);
+
+        std::ifstream file(path);
+        std::stringstream output;
+        output << file.rdbuf();
+        std::remove(path);
+        std::string text = output.str();
+
+        check(text.find("Error in phase 'validate': Message cannot be empty") != std::string::npos,
+              "empty message fails the validate phase");
+        check(text.find("Cleanup complete") != std::string::npos, "cleanup runs after the failure");
+        check(text.find("completed successfully") == std::string::npos, "failed run is not reported as success");
+        check(text.find("Speedup") == std::string::npos, "failed run prints no speedup");
+    }
+
+} // namespace
+
+int main() {
+    testDependencyOrder();
+    testFailureCancelsPendingAndWaitingTasks();
+    testCancelledTaskSettlesDependents();
+    testCancelBeforeRun();
+    testAppRunsCleanupAfterFailure();
+
+    if (failures > 0) {
+        std::cerr << failures << " check(s) failed\n";
+        return 1;
+    }
+    std::cout << "TaskGraph checks passed\n";
+    return 0;
+}